@@ -14,6 +14,8 @@ namespace logentia {
         extern bool ToggleTerminal;
         extern bool ToggleFile;
         extern bool AsyncMode;
+        extern bool WriterPool;
+        extern bool CombinedView;
 
         extern int MaxLevel;
         extern int  DetailLevel;
@@ -23,6 +25,7 @@ namespace logentia {
 
         extern std::string ProjectName;
         extern std::vector<std::string> TopicList;
+        extern std::vector<std::string> RouteList;
     }
 
     int Init();
@@ -11,6 +11,8 @@ namespace logentia {
     bool ToggleTerminal = true;
     bool ToggleFile     = true;
     bool AsyncMode      = true;
+    bool WriterPool     = false;                      // one writer per routed topic
+    bool CombinedView   = false;                      // mirror routed lines into main log file
 
     int MaxLevel = 3;
     int  DetailLevel   = 0;
@@ -20,6 +22,7 @@ namespace logentia {
     std::string FilePath    = "/log";                // root directory
     std::string ProjectName = "logentia_project";     // used if conf missing
     std::vector<std::string> TopicList;               // empty ⇒ all topics
+    std::vector<std::string> RouteList;               // "TOPIC" or "TOPIC=stream"; empty ⇒ TopicList
     // ————————————————
 
     } // namespace config
@@ -40,6 +43,8 @@ namespace logentia {
         KCONFIG_VAR(config::ToggleTerminal, "toggle.terminal", config::ToggleTerminal);
         KCONFIG_VAR(config::ToggleFile,     "toggle.file",     config::ToggleFile);
         KCONFIG_VAR(config::AsyncMode,      "toggle.async",    config::AsyncMode);
+        KCONFIG_VAR(config::WriterPool,     "toggle.pool",     config::WriterPool);
+        KCONFIG_VAR(config::CombinedView,   "toggle.combined", config::CombinedView);
 
         // [general]
         KCONFIG_VAR(config::MaxLevel,  "general.max_level", config::MaxLevel);
@@ -55,6 +60,9 @@ namespace logentia {
         // [list]
         KCONFIG_ARRAY(config::TopicList, "list.topics", config::TopicList);
 
+        // [routes]
+        KCONFIG_ARRAY(config::RouteList, "routes.topics", config::RouteList);
+
         return 0;
     }
 } // namespace logentia
@@ -7,11 +7,15 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 namespace logentia {
 
@@ -30,11 +34,32 @@ namespace {
     // ── async queue
     std::mutex                      q_mtx;
     std::condition_variable         q_cv;
-    std::queue<std::pair<std::string,int>> q;   // line + level
+    std::queue<std::tuple<std::string,int,bool>> q;   // line + level + terminal
     std::thread                     worker;
     std::atomic<bool>               running{false};
     std::once_flag                  start_flag;
 
+    // ── writer pool (one lane per routed stream, own queue + file)
+    struct topic_writer {
+        std::string                     name;
+        std::ofstream                   out;
+        std::mutex                      mtx;
+        std::condition_variable         cv;
+        std::queue<std::pair<std::string,int>> q;   // line + level
+        std::thread                     th;
+    };
+
+    struct string_hash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view s) const noexcept {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
+
+    std::vector<std::unique_ptr<topic_writer>> lanes;
+    // built once before any lane starts; read-only afterwards
+    std::unordered_map<std::string, topic_writer*, string_hash, std::equal_to<>> routes;
+
     // ── thread-naming
     thread_local std::string tl_name;
     thread_local int         tl_numeric_id = 0;
@@ -57,6 +82,13 @@ namespace {
         return oss.str();
     }
 
+    // Taken once per run so the main log and pool files share a prefix.
+    const std::string& run_stamp()
+    {
+        static const std::string stamp = timestamp();
+        return stamp;
+    }
+
     std::string level_tag(int lvl)
     {
         switch (lvl) {
@@ -80,8 +112,7 @@ namespace {
             std::filesystem::path dir = config::FilePath;
             dir /= config::ProjectName;
             std::filesystem::create_directories(dir);
-            std::string stamp = timestamp();
-            file_path = (dir / (stamp + "." + config::ProjectName + ".log")).string();
+            file_path = (dir / (run_stamp() + "." + config::ProjectName + ".log")).string();
             file_stream.open(file_path, std::ios::out | std::ios::trunc);
             file_ready = true;
         } catch (const std::exception& e) {
@@ -111,34 +142,36 @@ namespace {
         return out.str();
     }
 
-    void emit_to_sinks(const std::string& line, int lvl)
+    void emit_to_terminal(const std::string& line, int lvl)
+    {
+        std::lock_guard<std::mutex> lk(terminal_mtx);   // ➊ LOCK FIRST
+
+        std::string out_line;
+        if (config::ToggleColour) {
+            const char* col =
+               (lvl==1) ? "\033[1;31m" : (lvl==2) ? "\033[1;35m" :
+               (lvl==3) ? "\033[1;33m" : (lvl==4) ? "\033[1;32m" :
+               (lvl==5) ? "\033[1;36m" : "\033[0m";
+
+            out_line.reserve(line.size() + 20);
+            out_line += col;
+            out_line += line.substr(0,6);
+            out_line += "\033[0m";
+            out_line += line.substr(6);
+        } else {
+            out_line = line;
+        }
+
+        std::cout << out_line;        // ➋ single atomic write
+        std::cout.flush();
+    }
+
+    void emit_to_sinks(const std::string& line, int lvl, bool terminal = true)
     {
         GuardInternal g; 
 
         // ── terminal
-        if (config::ToggleTerminal)
-        {
-            std::lock_guard<std::mutex> lk(terminal_mtx);   // ➊ LOCK FIRST
-
-            std::string out_line;
-            if (config::ToggleColour) {
-                const char* col =
-                   (lvl==1) ? "\033[1;31m" : (lvl==2) ? "\033[1;35m" :
-                   (lvl==3) ? "\033[1;33m" : (lvl==4) ? "\033[1;32m" :
-                   (lvl==5) ? "\033[1;36m" : "\033[0m";
-
-                out_line.reserve(line.size() + 20);
-                out_line += col;
-                out_line += line.substr(0,6);
-                out_line += "\033[0m";
-                out_line += line.substr(6);
-            } else {
-                out_line = line;
-            }
-
-            std::cout << out_line;        // ➋ single atomic write
-            std::cout.flush();
-        }
+        if (config::ToggleTerminal && terminal) emit_to_terminal(line, lvl);
 
         // ── file
         if (config::ToggleFile) {
@@ -157,11 +190,11 @@ namespace {
             std::unique_lock<std::mutex> lk(q_mtx);
             q_cv.wait(lk, []{ return !q.empty() || !running.load(); });
             while (!q.empty()) {
-                auto [ln,lvl] = std::move(q.front()); q.pop();
+                auto [ln,lvl,term] = std::move(q.front()); q.pop();
                 lk.unlock();
                 {
                     std::lock_guard<std::mutex> guard(sink_mtx);
-                    emit_to_sinks(ln,lvl);
+                    emit_to_sinks(ln,lvl,term);
                 }
                 lk.lock();
             }
@@ -169,8 +202,154 @@ namespace {
         // flush leftovers
         std::lock_guard<std::mutex> guard(sink_mtx);
         while (!q.empty()) {
-            auto [ln,lvl] = std::move(q.front()); q.pop();
-            emit_to_sinks(ln,lvl);
+            auto [ln,lvl,term] = std::move(q.front()); q.pop();
+            emit_to_sinks(ln,lvl,term);
+        }
+    }
+
+    bool topic_allowed(std::string_view topic)
+    {
+        using namespace logentia::config;
+        if (!ToggleTopics) return true;
+        if (TopicList.empty()) return true;
+
+        for (const auto& t : TopicList) {
+            if (t == "*" || t == "all") return true;
+            if (t == topic) return true;
+        }
+        return false;
+    }
+
+    // Pool lane: owns terminal output and its own stream's file for the
+    // topics routed to it; the combined mirror is file-only.
+    void emit_to_lane(topic_writer& w, const std::string& line, int lvl)
+    {
+        GuardInternal g;
+        if (config::ToggleTerminal) emit_to_terminal(line, lvl);
+        if (w.out.is_open()) {
+            w.out << line;
+            w.out.flush();
+        }
+    }
+
+    void lane_loop(topic_writer& w)
+    {
+        while (running.load()) {
+            std::unique_lock<std::mutex> lk(w.mtx);
+            w.cv.wait(lk, [&]{ return !w.q.empty() || !running.load(); });
+            while (!w.q.empty()) {
+                auto [ln,lvl] = std::move(w.q.front()); w.q.pop();
+                lk.unlock();
+                emit_to_lane(w, ln, lvl);
+                lk.lock();
+            }
+        }
+        // flush leftovers
+        std::lock_guard<std::mutex> lk(w.mtx);
+        while (!w.q.empty()) {
+            auto [ln,lvl] = std::move(w.q.front()); w.q.pop();
+            emit_to_lane(w, ln, lvl);
+        }
+    }
+
+    std::string trim(std::string_view s)
+    {
+        const auto b = s.find_first_not_of(" \t");
+        if (b == std::string_view::npos) return {};
+        const auto e = s.find_last_not_of(" \t");
+        return std::string(s.substr(b, e - b + 1));
+    }
+
+    // Stream names become part of a file name under FilePath/ProjectName.
+    bool stream_name_ok(const std::string& s)
+    {
+        return s.find_first_of("/\\") == std::string::npos
+            && s.find("..") == std::string::npos;
+    }
+
+    // Route entries are "TOPIC" (own stream named after the topic) or
+    // "TOPIC=stream" (several topics may share a stream, hence a lane).
+    void start_pool()
+    {
+        GuardInternal g;    // diagnostics below must bypass tracking_buf
+
+        const auto& table = config::RouteList.empty() ? config::TopicList
+                                                      : config::RouteList;
+        std::unordered_map<std::string, topic_writer*> by_stream;
+
+        for (const auto& entry : table) {
+            const auto eq = entry.find('=');
+            std::string topic  = trim(std::string_view(entry).substr(0, eq));
+            std::string stream = (eq == std::string::npos)
+                                     ? topic
+                                     : trim(std::string_view(entry).substr(eq + 1));
+            if (topic.empty() || stream.empty()) continue;
+            if (topic == "*" || topic == "all") continue;
+            if (!stream_name_ok(stream)) {
+                std::cerr << "[LOGENTIA] Ignoring route '" << entry
+                          << "': invalid stream name.\n";
+                continue;
+            }
+            if (routes.count(topic)) continue;          // first route wins
+            if (!topic_allowed(topic)) {
+                std::cerr << "[LOGENTIA] Route for '" << topic
+                          << "' is filtered out by list.topics.\n";
+                continue;
+            }
+
+            auto& lane = by_stream[stream];
+            if (!lane) {
+                lanes.push_back(std::make_unique<topic_writer>());
+                lane = lanes.back().get();
+                lane->name = stream;
+            }
+            routes.emplace(std::move(topic), lane);
+        }
+
+        // A lane whose file cannot be opened is dropped, so its topics
+        // fall back to the main writer instead of vanishing.
+        if (!lanes.empty()) {
+            try {
+                std::filesystem::path dir = config::FilePath;
+                dir /= config::ProjectName;
+                std::filesystem::create_directories(dir);
+                for (auto& w : lanes) {
+                    const auto path = dir / (run_stamp() + "." + config::ProjectName + "."
+                                             + w->name + ".log");
+                    w->out.open(path, std::ios::out | std::ios::trunc);
+                    if (!w->out.is_open())
+                        std::cerr << "[LOGENTIA] Unable to open pool sink '"
+                                  << path.string() << "'; routing to main log.\n";
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "[LOGENTIA] Unable to open pool sinks: " << e.what()
+                          << "; routing to main log.\n";
+            }
+        }
+        std::erase_if(routes, [](const auto& r) { return !r.second->out.is_open(); });
+        std::erase_if(lanes,  [](const auto& w) { return !w->out.is_open(); });
+
+        for (auto& w : lanes)
+            w->th = std::thread(lane_loop, std::ref(*w));
+    }
+
+    void stop_pool()
+    {
+        for (auto& w : lanes) {
+            { std::lock_guard<std::mutex> lk(w->mtx); }
+            w->cv.notify_all();
+        }
+        for (auto& w : lanes)
+            if (w->th.joinable()) w->th.join();
+    }
+
+    void stop_async()
+    {
+        if (running.load()) {
+            running = false;
+            q_cv.notify_all();
+            stop_pool();
+            if (worker.joinable()) worker.join();
         }
     }
 
@@ -178,36 +357,43 @@ namespace {
     {
         if (!config::AsyncMode) return;
         running = true;
+        // Lanes only pay off with their own files; terminal output is
+        // serialised on terminal_mtx either way.
+        if (config::WriterPool && config::ToggleFile) start_pool();
         worker  = std::thread(writer_loop);
-        std::atexit([]{
-            if (running.load()) {
-                running = false;
-                q_cv.notify_all();
-                if (worker.joinable()) worker.join();
-            }
-        });
+        std::atexit(stop_async);
     }
 
-    void enqueue(const std::string& ln, int lvl)
+    void enqueue(const std::string& ln, int lvl, bool terminal = true)
     {
         {
             std::lock_guard<std::mutex> lk(q_mtx);
-            q.emplace(ln,lvl);
+            q.emplace(ln,lvl,terminal);
         }
         q_cv.notify_one();
     }
 
-    bool topic_allowed(std::string_view topic)
+    // Routed topics go to their lane (per-topic FIFO keeps ordering);
+    // everything else goes to the main writer. The combined mirror puts
+    // routed lines back on the single main writer, so it is opt-in.
+    void enqueue(const std::string& ln, std::string_view topic, int lvl)
     {
-        using namespace logentia::config;
-        if (!ToggleTopics) return true;
-        if (TopicList.empty()) return true;
+        const auto it = routes.find(topic);
+        if (it == routes.end()) { enqueue(ln, lvl); return; }
 
-        for (const auto& t : TopicList) {
-            if (t == "*" || t == "all") return true;
-            if (t == topic) return true;
+        // The mirror is queued under the lane mutex so the combined file
+        // keeps the lane's order for this topic (lock order: lane → q_mtx).
+        topic_writer& w = *it->second;
+        {
+            std::lock_guard<std::mutex> lk(w.mtx);
+            w.q.emplace(ln,lvl);
+            if (config::CombinedView) {
+                std::lock_guard<std::mutex> mk(q_mtx);
+                q.emplace(ln,lvl,false);
+            }
         }
-        return false;
+        w.cv.notify_one();
+        if (config::CombinedView) q_cv.notify_one();
     }
 
     class tracking_buf : public std::streambuf {
@@ -279,14 +465,7 @@ void hook_standard_streams() {
 }
 
 void init_async_writer()          { std::call_once(start_flag, start_async); }
-void shutdown_async_writer()
-{
-    if (running.load()) {
-        running = false;
-        q_cv.notify_all();
-        if (worker.joinable()) worker.join();
-    }
-}
+void shutdown_async_writer()      { stop_async(); }
 
 // helper to decide what details to add
 enum class Req { None, Time, Full };
@@ -351,7 +530,7 @@ void log(std::string_view msg, std::string_view topic, int lvl) {
 
     if (config::AsyncMode) {
         init_async_writer();
-        enqueue(line, lvl);
+        enqueue(line, topic, lvl);
     } else {
         std::lock_guard<std::mutex> g(sink_mtx);
         emit_to_sinks(line, lvl);
@@ -372,7 +551,7 @@ void time_log(std::string_view msg, std::string_view topic, int lvl) {
 
     if (config::AsyncMode) {
         init_async_writer();
-        enqueue(line, lvl);
+        enqueue(line, topic, lvl);
     } else {
         std::lock_guard<std::mutex> g(sink_mtx);
         emit_to_sinks(line, lvl);
@@ -388,7 +567,7 @@ void detailed_log(std::string_view msg, std::string_view topic, int lvl,
 
     if (config::AsyncMode) {
         init_async_writer();
-        enqueue(line, lvl);
+        enqueue(line, topic, lvl);
     } else {
         std::lock_guard<std::mutex> g(sink_mtx);
         emit_to_sinks(line, lvl);